@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/aot.cpp" "CMakeFiles/qlisp_runtime.dir/src/aot.cpp.o" "gcc" "CMakeFiles/qlisp_runtime.dir/src/aot.cpp.o.d"
+  "/root/repo/src/compiler.cpp" "CMakeFiles/qlisp_runtime.dir/src/compiler.cpp.o" "gcc" "CMakeFiles/qlisp_runtime.dir/src/compiler.cpp.o.d"
+  "/root/repo/src/gc.cpp" "CMakeFiles/qlisp_runtime.dir/src/gc.cpp.o" "gcc" "CMakeFiles/qlisp_runtime.dir/src/gc.cpp.o.d"
+  "/root/repo/src/interpreter.cpp" "CMakeFiles/qlisp_runtime.dir/src/interpreter.cpp.o" "gcc" "CMakeFiles/qlisp_runtime.dir/src/interpreter.cpp.o.d"
+  "/root/repo/src/jit.cpp" "CMakeFiles/qlisp_runtime.dir/src/jit.cpp.o" "gcc" "CMakeFiles/qlisp_runtime.dir/src/jit.cpp.o.d"
+  "/root/repo/src/memory.cpp" "CMakeFiles/qlisp_runtime.dir/src/memory.cpp.o" "gcc" "CMakeFiles/qlisp_runtime.dir/src/memory.cpp.o.d"
+  "/root/repo/src/objects.cpp" "CMakeFiles/qlisp_runtime.dir/src/objects.cpp.o" "gcc" "CMakeFiles/qlisp_runtime.dir/src/objects.cpp.o.d"
+  "/root/repo/src/platform/linux.cpp" "CMakeFiles/qlisp_runtime.dir/src/platform/linux.cpp.o" "gcc" "CMakeFiles/qlisp_runtime.dir/src/platform/linux.cpp.o.d"
+  "/root/repo/src/util.cpp" "CMakeFiles/qlisp_runtime.dir/src/util.cpp.o" "gcc" "CMakeFiles/qlisp_runtime.dir/src/util.cpp.o.d"
+  "/root/repo/src/vm.cpp" "CMakeFiles/qlisp_runtime.dir/src/vm.cpp.o" "gcc" "CMakeFiles/qlisp_runtime.dir/src/vm.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/qlisp_runtime.dir/src/aot.cpp.o"
+  "CMakeFiles/qlisp_runtime.dir/src/aot.cpp.o.d"
+  "CMakeFiles/qlisp_runtime.dir/src/compiler.cpp.o"
+  "CMakeFiles/qlisp_runtime.dir/src/compiler.cpp.o.d"
+  "CMakeFiles/qlisp_runtime.dir/src/gc.cpp.o"
+  "CMakeFiles/qlisp_runtime.dir/src/gc.cpp.o.d"
+  "CMakeFiles/qlisp_runtime.dir/src/interpreter.cpp.o"
+  "CMakeFiles/qlisp_runtime.dir/src/interpreter.cpp.o.d"
+  "CMakeFiles/qlisp_runtime.dir/src/jit.cpp.o"
+  "CMakeFiles/qlisp_runtime.dir/src/jit.cpp.o.d"
+  "CMakeFiles/qlisp_runtime.dir/src/memory.cpp.o"
+  "CMakeFiles/qlisp_runtime.dir/src/memory.cpp.o.d"
+  "CMakeFiles/qlisp_runtime.dir/src/objects.cpp.o"
+  "CMakeFiles/qlisp_runtime.dir/src/objects.cpp.o.d"
+  "CMakeFiles/qlisp_runtime.dir/src/platform/linux.cpp.o"
+  "CMakeFiles/qlisp_runtime.dir/src/platform/linux.cpp.o.d"
+  "CMakeFiles/qlisp_runtime.dir/src/util.cpp.o"
+  "CMakeFiles/qlisp_runtime.dir/src/util.cpp.o.d"
+  "CMakeFiles/qlisp_runtime.dir/src/vm.cpp.o"
+  "CMakeFiles/qlisp_runtime.dir/src/vm.cpp.o.d"
+  "libqlisp_runtime.a"
+  "libqlisp_runtime.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qlisp_runtime.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
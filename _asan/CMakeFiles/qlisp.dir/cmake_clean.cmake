@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/qlisp.dir/src/main.cpp.o"
+  "CMakeFiles/qlisp.dir/src/main.cpp.o.d"
+  "qlisp"
+  "qlisp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qlisp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -8,3 +8,8 @@
 (print "Fibonacci of 0 is " (fib 0))
 (print "Fibonacci of 1 is " (fib 1))
 (print "Fibonacci of 15 is " (fib 15))
+
+; Parameters used as Numbers, given something else
+(defun (fib-sum a b) (+ a b))
+(print "Sum of 2 and 3 is " (fib-sum 2 3))
+(print "Sum of \"fi\" and \"b\" is " (fib-sum "fi" "b"))
@@ -0,0 +1,27 @@
+;; Allocate enough short-lived lists to trigger several collections while
+;; keeping a few values alive in globals and hash tables
+(defun (natural-numbers n)
+    (defun (iter i)
+        (if (= i n)
+            i
+            (cons i (iter (+ i 1)))))
+    (iter 0))
+
+(setq kept (make-hash-table))
+(set-hash kept "squares" (map (lambda (a) (* a a)) (natural-numbers 10)))
+
+(defun (churn k acc)
+    (if (= k 0)
+        acc
+        (churn (- k 1) (+ acc (length (map (lambda (a) (* a 2)) (natural-numbers 100)))))))
+
+(print "Churned: " (churn 100 0))
+(print "Churned: " (churn 100 0))
+(print "Churned: " (churn 100 0))
+(print "Kept: " (get-hash kept "squares"))
+
+;; By now the table is old, storing fresh lists into it must keep them alive
+(set-hash kept "doubles" (map (lambda (a) (* a 2)) (natural-numbers 10)))
+(setq late (natural-numbers 5))
+(print "Churned: " (churn 100 0))
+(print "Kept: " (get-hash kept "doubles") " " late)
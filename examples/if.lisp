@@ -12,3 +12,11 @@
 (if (< a b)
     (print "1: a is less than b")
     (print "2: a is greater than b"))
+
+(if (> (* 2 3) 5)
+    (print "1: 6 is greater than 5")
+    (print "2: 6 is not greater than 5"))
+
+(if 0
+    (print "1: 0 is true")
+    (print "2: 0 is false"))
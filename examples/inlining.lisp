@@ -0,0 +1,25 @@
+;; Small functions are compiled into the bodies calling them. The inlined
+;; body is only used while the name is still bound to the function
+(defun (square x) (* x x))
+(defun (sum-squares n) (if (= n 0) 0 (+ (square n) (sum-squares (- n 1)))))
+
+;; Enough calls for the body to run as native code too
+(defun (sum-squares-times i)
+  (if (= i 1)
+      (sum-squares 10)
+      (begin (sum-squares 10) (sum-squares-times (- i 1)))))
+(print "Sum of squares to 10: " (sum-squares-times 60))
+
+;; Redefining the function takes the call in the bodies compiled before
+(defun (square x) (+ x x))
+(print "Sum of doubles to 10: " (sum-squares 10))
+
+;; So does binding the name around a call
+(defun (sum-cubes n)
+  (let ((square (lambda (x) (* x (* x x))))) (sum-squares n)))
+(print "Sum of cubes to 10: " (sum-cubes 10))
+(print "Doubles again: " (sum-squares 3))
+
+;; And setting it to a lambda
+(setq square (lambda (x) 1))
+(print "Counted to 10: " (sum-squares 10))
@@ -0,0 +1,23 @@
+;; Functions called often enough run as native code. Their typed body is only
+;; taken while the parameters hold Numbers, other values take the body
+;; without the types
+(defun (double-up x n) (if (= n 0) x (double-up (+ x x) (- n 1))))
+
+(defun (sum-powers i total)
+  (if (= i 60)
+      total
+      (sum-powers (+ i 1) (+ total (double-up 1 (remainder i 8))))))
+(print "Total of the powers of two: " (sum-powers 0 0))
+
+(print "Strings double up too: " (double-up "ab" 2))
+(print "Lists don't: " (double-up '(1 2) 1))
+(print "Back to Numbers: " (double-up 3 4))
+
+;; Native code switching between the two bodies from one call to the next
+(defun (alternate i)
+  (if (< i 4)
+      (begin
+        (print "Doubled: " (double-up (if (= (remainder i 2) 0) i "s") 1))
+        (alternate (+ i 1)))
+      nil))
+(alternate 0)
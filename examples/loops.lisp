@@ -0,0 +1,46 @@
+;; while runs its body as long as the test holds
+(setq i 0)
+(setq total 0)
+(while (< i 5)
+  (setq total (+ total i))
+  (setq i (+ i 1)))
+(print "Total of 0 to 4 is " total)
+
+;; dotimes counts its variable up to the count, then gives the result
+(print "dotimes gives " (dotimes (k 3 (* k 10)) (print "k = " k)))
+
+;; Loop variables are only bound during the loop
+(setq k "outer")
+(dotimes (k 2) (print "inner k = " k))
+(print "k after the loop is " k)
+
+;; do steps all of its variables at once
+(print "Powers of two up to 2^10: " (do ((n 0 (+ n 1)) (p 1 (* p 2))) ((= n 10) p)))
+(print "Swapped three times: "
+       (do ((x 1 y) (y 2 x) (n 0 (+ n 1))) ((= n 3) (cons x (cons y '())))))
+
+;; setq in the body assigns the variables around the loop
+(defun (sum-to n)
+  (let ((acc 0))
+    (begin
+      (dotimes (j n) (setq acc (+ acc j)))
+      acc)))
+(print "Sum below 10000 is " (sum-to 10000))
+
+(defun (count-down n)
+  (begin
+    (while (> n 0) (setq n (- n 1)))
+    n))
+(print "Counted down to " (count-down 100000))
+
+;; A loop evaluated in a function binds like the setq around it would, so a
+;; callee can't rebind what the caller's typed body relies on
+(defun (setup)
+  (begin 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17
+         (eval "(dotimes (i 1) (setq ev2 eval) (setq n \"oops\"))")))
+(setq ev2 print)
+(defun (k4 n)
+  (begin 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17
+         (setup) (ev2 "(setq n \"oops\")") (+ n 1)))
+(print "k4 " (k4 5))
+(print "ev2 is still print: " (= ev2 print))
@@ -0,0 +1,15 @@
+;; Calls in tail position don't grow the stack, a million of them in a row
+;; through if, cond and begin run in constant space
+(defun (is-even n) (if (= n 0) true (is-odd (- n 1))))
+(defun (is-odd n) (cond ((= n 0) false) (else (is-even (- n 1)))))
+(print "A million is even: " (is-even 1000000))
+(print "A million and one is odd: " (is-odd 1000001))
+
+(defun (ping n) (if (= n 0) "ping" (begin (pong (- n 1)))))
+(defun (pong n) (begin n (ping n)))
+(print "Ended on " (ping 1000000))
+
+;; Tail calls of variadic functions
+(defun (countdown n) (if (= n 0) "lift off" (step (- n 1) n "left")))
+(defun (step n . rest) (countdown n))
+(print "Counted down to " (countdown 1000000))
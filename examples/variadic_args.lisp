@@ -12,4 +12,19 @@
 (whatever 4 5 1 . (cdr '(2 4)))
 (variadic-fun . '(8 4 323))
 
+;; Rest lists that outlive the call keep their elements
+(setq saved (make-hash-table))
+(defun (save key . args) (set-hash saved key args))
+(save "first" 1 2 3)
+(save "second" 4 5)
+(defun (rest-of . args) (cdr args))
+(setq after-first (rest-of 1 2 3))
+(defun (with-zero . args) (cons 0 args))
+(setq zeroed (with-zero 6 7))
+(defun (show . args) (print args))
+(show "shown" 9 10)
+(variadic-fun "other" "calls" "in between")
+(print (get-hash saved "first") (get-hash saved "second"))
+(print after-first zeroed)
+
 ;; TODO: Test invalid syntax also